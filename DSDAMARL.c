@@ -68,22 +68,27 @@ f_regime_logic(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, atr
 
     // Assign regime based on priority
     var string regime = "Undefined"
+    var int regimeCode = 0  // Numeric regime for screening, 0 = Undefined
     if highVolatility and aboveSMA200 and strongTrend
         regime := "Strong Uptrend"
+        regimeCode := 1
     else if highVolatility and belowSMA200 and strongTrend
         regime := "Strong Downtrend"
+        regimeCode := 2
     else if highVolatility and noTrend
         regime := "High Volatility (Choppy)"
+        regimeCode := 3
     else if lowVolatility and noTrend
         regime := "Flat Market"
+        regimeCode := 4
     else if noTrend
         regime := "Choppy Market"
+        regimeCode := 5
     else if weakTrend
         regime := "Weak Trend"
-    else if highVolatility and close > ta.highest(close, atrLength)
-        regime := "Parabolic Spike"
+        regimeCode := 6
 
-    regime
+    [regime, regimeCode]
 
 
 
@@ -94,8 +99,8 @@ f_regime_logic(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, atr
 f_faith_index(trustLength) =>
     smaValue = ta.sma(close, trustLength)
     volatility = ta.stdev(close, trustLength)
-    resilienceScore = 1 - (volatility / smaValue)
-    contentZone = math.abs(close - smaValue) / (2 * volatility)
+    resilienceScore = smaValue != 0 ? 1 - (volatility / smaValue) : na
+    contentZone = volatility != 0 ? math.abs(close - smaValue) / (2 * volatility) : 0.0  // Flat window: close sits on the mean
     trustScore = 1 - math.min(contentZone, 1)
     (resilienceScore + trustScore) / 2
 
@@ -112,71 +117,37 @@ f_trending_ma(length) =>
 f_ranging_ma(length) =>
     ta.sma(close, length)
 
-f_volatile_ma(length) =>
-    ta.vwma(close, length)
-
 
 // Controller Logic
 f_brain(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, fastLength, slowLength, atrLength, flatMarketMultiplier, volatilitySpikeMultiplier, distanceThreshold) =>
     // Regime determination
-    regime = f_regime_logic(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, atrLength, volatilitySpikeMultiplier, flatMarketMultiplier)
+    [regime, regimeCode] = f_regime_logic(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, atrLength, volatilitySpikeMultiplier, flatMarketMultiplier)
     var float fastMA = na
     var float slowMA = na
 
-    // Common indicators
-    tightTrend = ta.ema(close, fastLength)  // A tight EMA that hugs the price
-    atr = ta.atr(atrLength)
+    // Regime MAs advance on every bar so a regime switch reads the exact value
+    trendingFast = f_trending_ma(fastLength)
+    trendingSlow = f_trending_ma(slowLength)
+    rangingFast = f_ranging_ma(fastLength)
+    rangingSlow = f_ranging_ma(slowLength)
 
     // Regime-Specific Logic
-    if regime == "Strong Uptrend" or regime == "Weak Trend"
+    if regime == "Strong Uptrend" or regime == "Weak Trend" or regime == "Strong Downtrend"
         // Use trend-following MAs
-        fastMA := f_trending_ma(fastLength)
-        slowMA := f_trending_ma(slowLength)
-
-    else if regime == "Strong Downtrend"
-        // Trend-following MAs for downtrends
-        fastMA := f_trending_ma(fastLength)
-        slowMA := f_trending_ma(slowLength)
-
-    else if regime == "Persistent Downtrend"
-        // Avoid trades if price is far below long-term SMA
-        sma200 = ta.sma(close, 200)
-        if close < sma200 * 0.95
-            fastMA := na
-            slowMA := na
-        else
-            fastMA := f_trending_ma(fastLength * 2)
-            slowMA := f_trending_ma(slowLength * 2)
-
-    else if regime == "Mean-Reverting High Volatility"
-        // Use a tight trend that hugs the price
-        fastMA := tightTrend
-        slowMA := tightTrend
-        if not f_distance_filter(close, tightTrend, distanceThreshold)  // Ignore trades too close to the trend
-            fastMA := na
-            slowMA := na
-
-    else if regime == "Choppy High Volatility"
-        // Use shorter-term volatility-adjusted MAs
-        fastMA := ta.vwma(close, fastLength)
-        slowMA := ta.vwma(close, slowLength)
+        fastMA := trendingFast
+        slowMA := trendingSlow
 
     else if regime == "Flat Market" or regime == "Choppy Market"
         // Use ranging MAs for low-volatility conditions
-        fastMA := f_ranging_ma(fastLength)
-        slowMA := f_ranging_ma(slowLength)
+        fastMA := rangingFast
+        slowMA := rangingSlow
 
-    else if regime == "Parabolic Spike"
-        // Avoid trades during parabolic spikes
+    // Apply distance filter
+    if not f_distance_filter(close, fastMA, distanceThreshold)
         fastMA := na
         slowMA := na
 
-    // Apply distance filter for all other regimes
-    if regime != "Mean-Reverting High Volatility" and not f_distance_filter(close, fastMA, distanceThreshold)
-        fastMA := na
-        slowMA := na
-
-    [fastMA, slowMA]
+    [fastMA, slowMA, regimeCode]
 
 
 
@@ -186,7 +157,7 @@ f_brain(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, fastLength
 
 
 // === Execution ===
-[fastDynamicMA, slowDynamicMA] = f_brain(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, fastMaLength, slowMaLength, atrLength, flatMarketMultiplier, volatilitySpikeMultiplier, distanceThreshold)
+[fastDynamicMA, slowDynamicMA, regimeCode] = f_brain(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, fastMaLength, slowMaLength, atrLength, flatMarketMultiplier, volatilitySpikeMultiplier, distanceThreshold)
 
 // === Plotting ===
 plot(fastDynamicMA, title="Fast Dynamic MA", color=color.green, linewidth=2)
@@ -195,6 +166,10 @@ plot(slowDynamicMA, title="Slow Dynamic MA", color=color.red, linewidth=2)
 // Fill between MAs
 fill(plot1=plot(fastDynamicMA, display=display.none), plot2=plot(slowDynamicMA, display=display.none),color=fastDynamicMA > slowDynamicMA ? color.new(color.green, 80) : color.new(color.red, 80), title="MA Fill")
 
+// Ranking values (data window only, see screener.c for the Pine Screener)
+plot(regimeCode, title="Regime Code", display=display.data_window)
+plot(f_faith_index(faithTrustLength), title="Faith Index", display=display.data_window)
+
 // Signals based on MA crossovers
 bullishCross = ta.crossover(fastDynamicMA, slowDynamicMA)
 bearishCross = ta.crossunder(fastDynamicMA, slowDynamicMA)
@@ -210,6 +185,10 @@ closeLong = bearishCross
 shortCondition = bearishCross
 closeShort = bullishCross
 
+// Signal bitset for replaying executions outside the platform (1 = long, 2 = close long, 4 = short, 8 = close short)
+signalBits = (longCondition ? 1 : 0) + (closeLong ? 2 : 0) + (shortCondition ? 4 : 0) + (closeShort ? 8 : 0)
+plot(signalBits, title="Signal Bits", display=display.data_window)
+
 
 
 // Enable long / short
@@ -27,15 +27,16 @@ AsymetricVolatility(source, length)=>
     totalMoves        = math.sum(math.abs(source - source[1]), length) 
     upVolatility      = math.sum(upMoves, length) / length
     downVolatility    = math.sum(downMoves, length) / length
-    upVolatilityPrc   = upVolatility / totalMoves * 20
-    downVolatilityPrc = downVolatility / totalMoves * 20
+    upVolatilityPrc   = totalMoves != 0 ? upVolatility / totalMoves * 20 : 0
+    downVolatilityPrc = totalMoves != 0 ? downVolatility / totalMoves * 20 : 0
     [upVolatilityPrc, downVolatilityPrc]
 
 McGinleyDynamic(source, fPeriod, fK, fExponent)=>
     period  = math.max(1.0, fPeriod)
     md      = 0.0
     priorMd = nz(md[1], source)
-    md      := priorMd + (source - priorMd) / math.min(period, math.max(1.0, fK * period * math.pow(source / priorMd, fExponent)))
+    divisor = priorMd != 0 ? math.min(period, math.max(1.0, fK * period * math.pow(source / priorMd, fExponent))) : period  // Zero prior: ratio is unbounded, divisor clamps to period
+    md      := priorMd + (source - priorMd) / divisor
     md
 
 // Calculations
@@ -78,6 +79,7 @@ backgroundColor = upVolatility > downVolatility ? color.rgb(60, 166, 75, 90) : c
 plot(upVolatility, title = "Upward volatility", color = color.rgb(60, 166, 75), style = plot.style_stepline)
 plot(downVolatility, title = "Downward volatility", color = color.rgb(178, 24, 44), style = plot.style_stepline)
 bgcolor(color = backgroundColor, title = "Background")
+plot(upVolatility - downVolatility, title = "Volatility Skew", display = display.data_window)
 
 
 // Indicator ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -89,6 +91,10 @@ closeLong = upVolatility < downVolatility
 shortCondition = upVolatility < downVolatility
 closeShort = upVolatility > downVolatility
 
+// Signal bitset for replaying executions outside the platform (1 = long, 2 = close long, 4 = short, 8 = close short)
+signalBits = (longCondition ? 1 : 0) + (closeLong ? 2 : 0) + (shortCondition ? 4 : 0) + (closeShort ? 8 : 0)
+plot(signalBits, title="Signal Bits", display=display.data_window)
+
 
 
 // Enable long / short
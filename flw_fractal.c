@@ -1,7 +1,7 @@
 //@version=5
 indicator("FDI and LHEA Combined with Williams Fractal", overlay=true)
 
-length = input.int(30, title="Length")
+length = input.int(30, title="Length", minval=2)
 smoothing_length = input.int(1, title="Smoothing Length")
 smoothing = input.string("ZLEMA", title="Smoothing", options=["MG","RMA", "SMA", "EMA", "WMA",  "ZLEMA", "Super Smoother Filter", "2 Pole Butterworth Filter", "3 Pole Butterworth Filter", "Ehlers Hamming MA", "Ehlers Instantaneous Trendline"])
 fractal_period = input.int(title="Fractal Periods", defval=9, minval=1)  // Williams Fractal Period
@@ -12,7 +12,7 @@ smoothed_ma(source, length) =>
     if smoothing == "MG"
         mg = 0.0
         _ema = ta.ema(source, length)
-        mg := na(mg[1]) ? _ema : mg[1] + (source - mg[1]) / (length * math.pow(source / mg[4], 1))
+        mg := na(mg[1]) ? _ema : mg[1] + (source - mg[1]) / (mg[4] != 0 ? math.min(length, math.max(1.0, length * source / mg[4])) : length)  // Divisor clamped to [1, length] like the other McGinley implementations, zero prior uses length
         mg
     else if smoothing == "RMA"
         ta.rma(source, length)
@@ -52,7 +52,7 @@ smoothed_ma(source, length) =>
         filt = 0.0
         coef = 0.0
         for i = 0 to length - 1
-            sine = math.sin(pedestal + ((math.pi - (2 * pedestal)) * i / (length - 1)))
+            sine = math.sin(pedestal + ((math.pi - (2 * pedestal)) * (length > 1 ? i / (length - 1) : 0)))  // Single-tap window has no spread
             filt := filt + (sine * nz(source[i]))
             coef := coef + sine
         filt := coef != 0 ? filt / coef : 0
@@ -75,7 +75,7 @@ _LHEA(length) =>
     atr = smoothed_ma(ta.tr(true), length)
     hh = ta.highest(high, length)
     ll = ta.lowest(low, length)
-    H = (math.log(hh - ll) - math.log(atr)) / math.log(length)
+    H = hh > ll and atr > 0 ? (math.log(hh - ll) - math.log(atr)) / math.log(length) : na  // Flat window has no defined exponent
     H
 
 lhea_raw = _LHEA(length)
@@ -85,13 +85,15 @@ _FDI(length) =>
     hh = ta.highest(close, length)
     ll = ta.lowest(close, length)
     cumulative_length = 0.0
-    for i = 1 to length - 1
-        diff = (close[i] - ll) / (hh - ll)
-        diff_next = (close[i + 1] - ll) / (hh - ll)
-        cumulative_length := cumulative_length + math.sqrt(math.pow(diff - diff_next, 2) + (1 / math.pow(length, 2)))
-    1 + (math.log(cumulative_length) + math.log(2)) / math.log(2 * length)
+    if hh > ll  // Skip flat windows, the normalisation below would divide by zero
+        for i = 1 to length - 1
+            diff = (close[i] - ll) / (hh - ll)
+            diff_next = (close[i + 1] - ll) / (hh - ll)
+            cumulative_length := cumulative_length + math.sqrt(math.pow(diff - diff_next, 2) + (1 / math.pow(length, 2)))
+    hh > ll ? 1 + (math.log(cumulative_length) + math.log(2)) / math.log(2 * length) : na
 
 fdi_raw = _FDI(length)
+plot(fdi_raw, title="FDI", display=display.data_window)  // Screener value, lower is more trending
 
 // Normalize and Invert FDI to a 0-1 scale
 fdi_normalized_inverted = 1 - ((fdi_raw - 1) / (2 - 1))
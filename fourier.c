@@ -69,17 +69,32 @@ short_take_profit = close - dynamic_risk_factor * math.abs(weighted_slope) * 100
 // Trailing Stop-Loss for Active Positions
 trailing_points = dynamic_risk_factor * 50
 
+// Bot web-link alert - {{strategy.order.comment}}
+botLONG = ''
+botCLOSELONG = ''
+botSHORT = ''
+botCLOSESHORT = ''
+
 // Trade Execution
 if (long_condition and long_enabled)
-    strategy.entry("Buy", strategy.long)
-    strategy.exit("Sell", from_entry="Buy", stop=long_stop_loss, limit=long_take_profit, trail_points=trailing_points)
+    strategy.entry("Buy", strategy.long, comment=botLONG)  // {{strategy.order.comment}}
+    strategy.exit("Sell", from_entry="Buy", stop=long_stop_loss, limit=long_take_profit, trail_points=trailing_points, comment=botCLOSELONG)  // {{strategy.order.comment}}
     last_trade_time := bar_index
 
 if (short_condition and short_enabled)
-    strategy.entry("Sell", strategy.short)
-    strategy.exit("Cover", from_entry="Sell", stop=short_stop_loss, limit=short_take_profit, trail_points=trailing_points)
+    strategy.entry("Sell", strategy.short, comment=botSHORT)  // {{strategy.order.comment}}
+    strategy.exit("Cover", from_entry="Sell", stop=short_stop_loss, limit=short_take_profit, trail_points=trailing_points, comment=botCLOSESHORT)  // {{strategy.order.comment}}
     last_trade_time := bar_index
 
+// Signal bitset for replaying executions outside the platform (1 = long, 4 = short), plus the exit levels the orders use
+signalBits = (long_condition and long_enabled ? 1 : 0) + (short_condition and short_enabled ? 4 : 0)
+plot(signalBits, title="Signal Bits", display=display.data_window)
+plot(long_stop_loss, title="Long Stop Loss", display=display.data_window)
+plot(long_take_profit, title="Long Take Profit", display=display.data_window)
+plot(short_stop_loss, title="Short Stop Loss", display=display.data_window)
+plot(short_take_profit, title="Short Take Profit", display=display.data_window)
+plot(trailing_points, title="Trailing Points", display=display.data_window)
+
 // Visualization
 plotshape(long_condition and long_enabled, style=shape.triangledown, location=location.belowbar,  color=#F44336, size=size.auto)
 plotshape(short_condition and short_enabled, style=shape.triangleup,   location=location.abovebar, color=#009688, size=size.auto)
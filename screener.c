@@ -0,0 +1,137 @@
+//@version=5
+// Companion to DSDAMARL.c, asymmetric_volatility.c and flw_fractal.c: the Pine Screener only loads indicator() scripts,
+// so the ranking values are recomputed here with the same inputs and defaults. Mirrored code, keep in sync:
+//   DSDAMARL.c              f_compute_dx, f_regime_logic (as f_regime_code, code only), f_faith_index
+//   asymmetric_volatility.c AsymetricVolatility, McGinleyDynamic, the Bps/Prc and McGinley smoothing calculations
+//   flw_fractal.c           _FDI
+indicator("Strategy Screener Values", "ScreenV", overlay=false)
+
+// Regime (DSDAMARL.c)
+trendThresholdStrong = input.float(35.0, title="Strong Trend Threshold (ADX)", group="Regime")
+trendThresholdWeak = input.float(15.0, title="Weak Trend Threshold (ADX)", group="Regime")
+regimeSwitchLength = input.int(14, title="Regime Detection Length", group="Regime")
+atrLength = input.int(14, title="ATR Length for Volatility", group="Regime")
+flatMarketMultiplier = input.float(5.0, title="Flat Market ATR Multiplier", group="Regime")
+volatilitySpikeMultiplier = input.float(2.5, title="Volatility Spike Multiplier", group="Regime")
+faithTrustLength = input.int(288, title="Faith Trust Length (Periods)", group="Regime")
+
+// Asymmetric volatility (asymmetric_volatility.c)
+volLengthInput = input.int(defval = 15, title = "Length", minval = 1, group = "Asymmetric Volatility")
+sourceInput = input.source(defval = close, title = "Source", group = "Asymmetric Volatility")
+measureInput = input.string(defval = "Bps", title = "Measure", options = ["Bps", "Prc"], group = "Asymmetric Volatility")
+useMcGinleyUnput = input.bool(defval = true, title = "Use McGinley Dynamic smoothing?", group = "Asymmetric Volatility")
+mcGinleyLengthInput = input.int(defval = 5, minval = 1, title = "McGinley Dynamic length", group = "Asymmetric Volatility")
+mcGinleyKInput = input.float(defval = 0.6, title = "McGinley k value", minval = 0.1, step = 0.05, group = "Asymmetric Volatility")
+mcGinleyExponentInput = input.float(defval = 3.0, title = "McGinley exponent", minval = 1.0, step = 0.1, group = "Asymmetric Volatility")
+clusterLookbackInput = input.int(defval = 1, title = "Cluster lookback period", minval = 1, step = 1, group = "Asymmetric Volatility")
+clusteringAdjustmentInput = input.float(defval = 0, title = "Clustering Adjustment Factor", step = 0.05, minval = 0.0, maxval = 1.0, group = "Asymmetric Volatility")
+
+// Fractal dimension (flw_fractal.c)
+fdiLength = input.int(30, title="FDI Length", minval=2, group="Fractal Dimension")
+
+// === Regime ===
+f_compute_dx(regimeSwitchLength) =>
+    trueRange = ta.tr(true)
+    plusDM = high - high[1] > low[1] - low ? math.max(high - high[1], 0) : 0
+    minusDM = low[1] - low > high - high[1] ? math.max(low[1] - low, 0) : 0
+    smoothedTR = ta.rma(trueRange, regimeSwitchLength)
+    smoothedPlusDM = ta.rma(plusDM, regimeSwitchLength)
+    smoothedMinusDM = ta.rma(minusDM, regimeSwitchLength)
+    DIPlus = smoothedTR != 0 ? (smoothedPlusDM / smoothedTR) * 100 : 0
+    DIMinus = smoothedTR != 0 ? (smoothedMinusDM / smoothedTR) * 100 : 0
+    sumDI = DIPlus + DIMinus
+    sumDI != 0 ? (math.abs(DIPlus - DIMinus) / sumDI) * 100 : 0
+
+// Same priority as f_regime_logic in DSDAMARL.c: 1 Strong Uptrend, 2 Strong Downtrend, 3 High Volatility (Choppy),
+// 4 Flat Market, 5 Choppy Market, 6 Weak Trend, 0 Undefined
+f_regime_code(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, atrLength, volatilitySpikeMultiplier, flatMarketMultiplier) =>
+    ADX = ta.rma(f_compute_dx(regimeSwitchLength), regimeSwitchLength)
+    atr = ta.atr(atrLength)
+    avgVolatility = ta.sma(atr, atrLength)
+    sma200 = ta.sma(close, 200)
+    highVolatility = atr > avgVolatility * volatilitySpikeMultiplier
+    lowVolatility = atr < avgVolatility / flatMarketMultiplier
+    strongTrend = ADX > trendThresholdStrong
+    weakTrend = ADX > trendThresholdWeak and ADX <= trendThresholdStrong
+    noTrend = ADX <= trendThresholdWeak
+    var int regimeCode = 0
+    if highVolatility and close > sma200 and strongTrend
+        regimeCode := 1
+    else if highVolatility and close < sma200 and strongTrend
+        regimeCode := 2
+    else if highVolatility and noTrend
+        regimeCode := 3
+    else if lowVolatility and noTrend
+        regimeCode := 4
+    else if noTrend
+        regimeCode := 5
+    else if weakTrend
+        regimeCode := 6
+    regimeCode
+
+f_faith_index(trustLength) =>
+    smaValue = ta.sma(close, trustLength)
+    volatility = ta.stdev(close, trustLength)
+    resilienceScore = smaValue != 0 ? 1 - (volatility / smaValue) : na
+    contentZone = volatility != 0 ? math.abs(close - smaValue) / (2 * volatility) : 0.0  // Flat window: close sits on the mean
+    trustScore = 1 - math.min(contentZone, 1)
+    (resilienceScore + trustScore) / 2
+
+// === Asymmetric Volatility ===
+AsymetricVolatility(source, length)=>
+    upMoves           = math.max(source - source[1], 0)
+    downMoves         = math.max(source[1] - source, 0)
+    totalMoves        = math.sum(math.abs(source - source[1]), length)
+    upVolatility      = math.sum(upMoves, length) / length
+    downVolatility    = math.sum(downMoves, length) / length
+    upVolatilityPrc   = totalMoves != 0 ? upVolatility / totalMoves * 20 : 0
+    downVolatilityPrc = totalMoves != 0 ? downVolatility / totalMoves * 20 : 0
+    [upVolatilityPrc, downVolatilityPrc]
+
+McGinleyDynamic(source, fPeriod, fK, fExponent)=>
+    period  = math.max(1.0, fPeriod)
+    md      = 0.0
+    priorMd = nz(md[1], source)
+    divisor = priorMd != 0 ? math.min(period, math.max(1.0, fK * period * math.pow(source / priorMd, fExponent))) : period  // Zero prior: ratio is unbounded, divisor clamps to period
+    md      := priorMd + (source - priorMd) / divisor
+    md
+
+float upVolatility   = na
+float downVolatility = na
+
+if measureInput == "Bps"
+    upMoves   = math.max(sourceInput - sourceInput[1], 0)
+    downMoves = math.max(sourceInput[1] - sourceInput, 0)
+    upVolatility    := math.sum(upMoves, volLengthInput) / volLengthInput
+    downVolatility  := math.sum(downMoves, volLengthInput) / volLengthInput
+else
+    [upVolatilityPrc, downVolatilityPrc] = AsymetricVolatility(sourceInput, volLengthInput)
+    upVolatility   := upVolatilityPrc * 2
+    downVolatility := downVolatilityPrc * 2
+
+if useMcGinleyUnput
+    mcGinleyUpVolatility = McGinleyDynamic(upVolatility, mcGinleyLengthInput, mcGinleyKInput, mcGinleyExponentInput)
+    mcGinleyDownVolatility = McGinleyDynamic(downVolatility, mcGinleyLengthInput, mcGinleyKInput, mcGinleyExponentInput)
+    volatilityPerf = ta.ema(math.abs(sourceInput - sourceInput[1]), clusterLookbackInput)
+    adjustmentFactor = 1 - (clusteringAdjustmentInput * volatilityPerf / 100)
+    adjustmentFactor := math.max(0.0, math.min(1.0, adjustmentFactor))
+    upVolatility   := mcGinleyUpVolatility * adjustmentFactor
+    downVolatility := mcGinleyDownVolatility * adjustmentFactor
+
+// === Fractal Dimension ===
+_FDI(length) =>
+    hh = ta.highest(close, length)
+    ll = ta.lowest(close, length)
+    cumulative_length = 0.0
+    if hh > ll  // Skip flat windows, the normalisation below would divide by zero
+        for i = 1 to length - 1
+            diff = (close[i] - ll) / (hh - ll)
+            diff_next = (close[i + 1] - ll) / (hh - ll)
+            cumulative_length := cumulative_length + math.sqrt(math.pow(diff - diff_next, 2) + (1 / math.pow(length, 2)))
+    hh > ll ? 1 + (math.log(cumulative_length) + math.log(2)) / math.log(2 * length) : na
+
+// === Screener Values ===
+plot(f_regime_code(trendThresholdStrong, trendThresholdWeak, regimeSwitchLength, atrLength, volatilitySpikeMultiplier, flatMarketMultiplier), title="Regime Code", style=plot.style_stepline)
+plot(f_faith_index(faithTrustLength), title="Faith Index")
+plot(upVolatility - downVolatility, title="Volatility Skew")
+plot(_FDI(fdiLength), title="FDI")
@@ -77,7 +77,8 @@ mcginley_dynamic(series float src, float fPeriod, float fK, float fExponent) =>
     period = math.max(1.0, fPeriod)
     float md = na
     prior_md = nz(md[1], src)
-    md := prior_md + (src - prior_md) / math.min(period, math.max(1.0, fK * period * math.pow(src / prior_md, fExponent)))
+    divisor = prior_md != 0 ? math.min(period, math.max(1.0, fK * period * math.pow(src / prior_md, fExponent))) : period  // Zero prior: ratio is unbounded, divisor clamps to period
+    md := prior_md + (src - prior_md) / divisor
     md
 
 // Calculate Supertrend with Clustering Influence
@@ -130,6 +131,10 @@ closeShort = trend == 1 and ta.valuewhen(trend == 1, trend, 1) == 1
 // New Condition for Closing Part of Short if the Close is Above Midpoint (using full bar close)
 closeShortPartial = barstate.isconfirmed and close > midpoint
 
+// Signal bitset for replaying executions outside the platform (1 = long, 2 = close long, 4 = short, 8 = close short, 16 = partial close long, 32 = partial close short)
+signalBits = (longCondition ? 1 : 0) + (closeLong ? 2 : 0) + (shortCondition ? 4 : 0) + (closeShort ? 8 : 0) + (closeLongPartial ? 16 : 0) + (closeShortPartial ? 32 : 0)
+plot(signalBits, title="Signal Bits", display=display.data_window)
+
 // Enable long / short
 longEnabled = input(true)
 shortEnabled = input(false)